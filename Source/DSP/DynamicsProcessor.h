@@ -25,14 +25,22 @@ public:
         this->amount = juce::jlimit(-1.0f, 1.0f, amount);
     }
 
-    void process(juce::AudioBuffer<float>& buffer)
+    bool isActive() const { return std::abs(amount) >= 0.001f; }
+
+    // keyL/keyR: optional detector key (sidechain or filtered input).
+    // When null the envelope follows the processed signal itself.
+    void process(juce::AudioBuffer<float>& buffer, const float* keyL = nullptr, const float* keyR = nullptr)
     {
-        if (std::abs(amount) < 0.001f)
+        if (!isActive())
             return; // Bypass when centered
 
         auto* leftChannel = buffer.getWritePointer(0);
         auto* rightChannel = buffer.getNumChannels() > 1 ? buffer.getWritePointer(1) : nullptr;
 
+        const float* detectL = keyL != nullptr ? keyL : leftChannel;
+        const float* detectR = keyL != nullptr ? (keyR != nullptr ? keyR : keyL)
+                                               : (rightChannel != nullptr ? rightChannel : leftChannel);
+
         const int numSamples = buffer.getNumSamples();
 
         // Parameters based on amount
@@ -48,8 +56,8 @@ public:
             float inR = rightChannel ? rightChannel[i] : inL;
 
             // Envelope follower (peak)
-            float peakL = std::abs(inL);
-            float peakR = std::abs(inR);
+            float peakL = std::abs(detectL[i]);
+            float peakR = std::abs(detectR[i]);
 
             float coefL = peakL > envL ? attackCoef : releaseCoef;
             float coefR = peakR > envR ? attackCoef : releaseCoef;
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <cmath>
+
+// Detector key filter: high-pass followed by a tilt shelf, run as one pass
+// over the whole block. Both stages of both channels share one SIMD register,
+// lanes { L HPF, R HPF, L tilt, R tilt }. The tilt lanes run one sample behind
+// the HPF lanes so every lane has its input ready at each step.
+class KeyFilter
+{
+public:
+    static constexpr float minHpfHz = 20.0f;  // Bottom of the range = HPF off
+    static constexpr float tiltPivotHz = 1000.0f;
+
+    void prepare(double sampleRate)
+    {
+        this->sampleRate = sampleRate;
+        hpfHz = -1.0f;
+        tiltDb = -100.0f;
+        setParameters(minHpfHz, 0.0f);
+        reset();
+    }
+
+    void reset()
+    {
+        state1 = Vec::expand(0.0f);
+        state2 = Vec::expand(0.0f);
+    }
+
+    void setParameters(float newHpfHz, float newTiltDb)
+    {
+        newHpfHz = juce::jlimit(minHpfHz, float(sampleRate) * 0.45f, newHpfHz);
+
+        if (newHpfHz != hpfHz)
+        {
+            hpfHz = newHpfHz;
+            hpfOn = hpfHz > minHpfHz + 0.5f;
+            hpf = normalise(juce::dsp::IIR::ArrayCoefficients<float>::makeHighPass(sampleRate, hpfHz));
+        }
+
+        if (newTiltDb != tiltDb)
+        {
+            tiltDb = newTiltDb;
+            tiltOn = std::abs(tiltDb) > 0.05f;
+
+            // Low shelf cut by the full tilt, whole band lifted by half of it,
+            // so lows and highs move by -/+ half the tilt around tiltPivotHz
+            float halfGain = juce::Decibels::decibelsToGain(tiltDb * 0.5f);
+            tilt = normalise(juce::dsp::IIR::ArrayCoefficients<float>::makeLowShelf(
+                sampleRate, tiltPivotHz, 0.7071f, 1.0f / (halfGain * halfGain)));
+            tilt.b0 *= halfGain;
+            tilt.b1 *= halfGain;
+            tilt.b2 *= halfGain;
+        }
+    }
+
+    bool isActive() const { return hpfOn || tiltOn; }
+
+    // Filters inL/inR into outL/outR (may alias for in-place use).
+    // Pass inR/outR as nullptr for a mono key.
+    void process(const float* inL, const float* inR, float* outL, float* outR, int numSamples)
+    {
+        if (numSamples <= 0)
+            return;
+
+        if (inR == nullptr || outR == nullptr)
+        {
+            inR = nullptr;
+            outR = nullptr;
+        }
+
+        // Inactive stages become pass-through so the loop stays branch-free
+        const Biquad h = hpfOn ? hpf : Biquad();
+        const Biquad t = tiltOn ? tilt : Biquad();
+
+        const auto b0 = stageLanes(h.b0, t.b0);
+        const auto b1 = stageLanes(h.b1, t.b1);
+        const auto b2 = stageLanes(h.b2, t.b2);
+        const auto a1 = stageLanes(h.a1, t.a1);
+        const auto a2 = stageLanes(h.a2, t.a2);
+
+        // Prologue: sample 0 through the HPF lanes only
+        float hpfOutL = stepLane(h, laneHpfL, inL[0]);
+        float hpfOutR = inR != nullptr ? stepLane(h, laneHpfR, inR[0]) : 0.0f;
+
+        alignas(Vec) float x[Vec::SIMDNumElements] {};
+        alignas(Vec) float y[Vec::SIMDNumElements] {};
+
+        Vec s1 = state1;
+        Vec s2 = state2;
+
+        // Steady state: HPF of sample i alongside tilt of sample i - 1
+        for (int i = 1; i < numSamples; ++i)
+        {
+            x[laneHpfL] = inL[i];
+            x[laneHpfR] = inR != nullptr ? inR[i] : 0.0f;
+            x[laneTiltL] = hpfOutL;
+            x[laneTiltR] = hpfOutR;
+
+            const Vec in = Vec::fromRawArray(x);
+            const Vec out = b0 * in + s1;
+            s1 = b1 * in - a1 * out + s2;
+            s2 = b2 * in - a2 * out;
+            out.copyToRawArray(y);
+
+            hpfOutL = y[laneHpfL];
+            hpfOutR = y[laneHpfR];
+            outL[i - 1] = y[laneTiltL];
+            if (outR != nullptr)
+                outR[i - 1] = y[laneTiltR];
+        }
+
+        state1 = s1;
+        state2 = s2;
+
+        // Epilogue: last sample through the tilt lanes only
+        outL[numSamples - 1] = stepLane(t, laneTiltL, hpfOutL);
+        if (outR != nullptr)
+            outR[numSamples - 1] = stepLane(t, laneTiltR, hpfOutR);
+    }
+
+private:
+    using Vec = juce::dsp::SIMDRegister<float>;
+    static_assert(Vec::SIMDNumElements >= 4, "KeyFilter needs at least four SIMD lanes");
+
+    static constexpr size_t laneHpfL = 0;
+    static constexpr size_t laneHpfR = 1;
+    static constexpr size_t laneTiltL = 2;
+    static constexpr size_t laneTiltR = 3;
+
+    struct Biquad
+    {
+        float b0 = 1.0f, b1 = 0.0f, b2 = 0.0f, a1 = 0.0f, a2 = 0.0f;
+    };
+
+    static Biquad normalise(const std::array<float, 6>& c)
+    {
+        float a0Inv = 1.0f / c[3];
+        return { c[0] * a0Inv, c[1] * a0Inv, c[2] * a0Inv, c[4] * a0Inv, c[5] * a0Inv };
+    }
+
+    static Vec stageLanes(float hpfValue, float tiltValue)
+    {
+        Vec v = Vec::expand(0.0f);
+        v.set(laneHpfL, hpfValue);
+        v.set(laneHpfR, hpfValue);
+        v.set(laneTiltL, tiltValue);
+        v.set(laneTiltR, tiltValue);
+        return v;
+    }
+
+    // Scalar transposed direct form II step on a single lane of the shared state
+    float stepLane(const Biquad& c, size_t lane, float in)
+    {
+        float s1 = state1.get(lane);
+        float s2 = state2.get(lane);
+
+        float out = c.b0 * in + s1;
+        state1.set(lane, c.b1 * in - c.a1 * out + s2);
+        state2.set(lane, c.b2 * in - c.a2 * out);
+        return out;
+    }
+
+    double sampleRate = 44100.0;
+    float hpfHz = minHpfHz;
+    float tiltDb = 0.0f;
+    bool hpfOn = false;
+    bool tiltOn = false;
+    Biquad hpf;
+    Biquad tilt;
+    Vec state1 = Vec::expand(0.0f);
+    Vec state2 = Vec::expand(0.0f);
+};
@@ -4,6 +4,7 @@
 OneKnobAudioProcessor::OneKnobAudioProcessor()
     : AudioProcessor(BusesProperties()
                      .withInput("Input", juce::AudioChannelSet::stereo(), true)
+                     .withInput("Sidechain", juce::AudioChannelSet::stereo(), false)
                      .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
       apvts(*this, nullptr, "Parameters", createParameterLayout())
 {
@@ -31,6 +32,28 @@ juce::AudioProcessorValueTreeState::ParameterLayout OneKnobAudioProcessor::creat
         "Bypass",
         false));
 
+    // Sidechain: detect from the sidechain bus instead of the input
+    params.push_back(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID("sidechain", 1),
+        "Sidechain",
+        false));
+
+    // Key filter: high-pass on the detector, bottom of the range = off
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID("keyHpf", 1),
+        "Key HPF",
+        juce::NormalisableRange<float>(KeyFilter::minHpfHz, 500.0f, 1.0f, 0.5f),
+        KeyFilter::minHpfHz,
+        juce::AudioParameterFloatAttributes().withLabel("Hz")));
+
+    // Key tilt around 1 kHz: positive = brighter key
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID("keyTilt", 1),
+        "Key Tilt",
+        juce::NormalisableRange<float>(-6.0f, 6.0f, 0.1f),
+        0.0f,
+        juce::AudioParameterFloatAttributes().withLabel("dB")));
+
     return { params.begin(), params.end() };
 }
 
@@ -50,9 +73,12 @@ void OneKnobAudioProcessor::setCurrentProgram(int) {}
 const juce::String OneKnobAudioProcessor::getProgramName(int) { return {}; }
 void OneKnobAudioProcessor::changeProgramName(int, const juce::String&) {}
 
-void OneKnobAudioProcessor::prepareToPlay(double sampleRate, int)
+void OneKnobAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
     dynamicsProcessor.prepare(sampleRate);
+    keyFilter.prepare(sampleRate);
+    keyFilterRunning = false;
+    keyBuffer.setSize(2, samplesPerBlock);
 }
 
 void OneKnobAudioProcessor::releaseResources()
@@ -68,6 +94,12 @@ bool OneKnobAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts) c
     if (layouts.getMainOutputChannelSet() != layouts.getMainInputChannelSet())
         return false;
 
+    auto sidechain = layouts.getChannelSet(true, 1);
+    if (!sidechain.isDisabled()
+        && sidechain != juce::AudioChannelSet::mono()
+        && sidechain != juce::AudioChannelSet::stereo())
+        return false;
+
     return true;
 }
 
@@ -77,12 +109,79 @@ void OneKnobAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     juce::ScopedNoDenormals noDenormals;
 
     bool bypassed = apvts.getRawParameterValue("bypass")->load() > 0.5f;
-    if (bypassed)
-        return;
 
     float amount = apvts.getRawParameterValue("amount")->load() / 100.0f; // Normalize to -1 to +1
     dynamicsProcessor.setAmount(amount);
-    dynamicsProcessor.process(buffer);
+
+    keyFilter.setParameters(apvts.getRawParameterValue("keyHpf")->load(),
+                            apvts.getRawParameterValue("keyTilt")->load());
+
+    auto sidechainBuffer = getBusCount(true) > 1 ? getBusBuffer(buffer, true, 1)
+                                                 : juce::AudioBuffer<float>();
+    bool useSidechain = apvts.getRawParameterValue("sidechain")->load() > 0.5f
+                        && sidechainBuffer.getNumChannels() > 0;
+
+    // Filter state only carries over while it keeps filtering the same key;
+    // after a skipped block or a source switch it would smear stale audio in
+    bool filterKey = !bypassed && dynamicsProcessor.isActive() && keyFilter.isActive();
+    if (filterKey && (!keyFilterRunning || useSidechain != keyFromSidechain))
+        keyFilter.reset();
+
+    keyFilterRunning = filterKey;
+    keyFromSidechain = useSidechain;
+
+    if (bypassed || !dynamicsProcessor.isActive())
+        return;
+
+    auto mainBuffer = getBusBuffer(buffer, false, 0);
+    const int numSamples = mainBuffer.getNumSamples();
+
+    // Sidechain key: read straight from the bus and filter in place
+    if (useSidechain)
+    {
+        auto* keyL = sidechainBuffer.getWritePointer(0);
+        auto* keyR = sidechainBuffer.getNumChannels() > 1 ? sidechainBuffer.getWritePointer(1) : nullptr;
+
+        if (filterKey)
+            keyFilter.process(keyL, keyR, keyL, keyR, numSamples);
+
+        dynamicsProcessor.process(mainBuffer, keyL, keyR);
+        return;
+    }
+
+    // Internal key: unfiltered detection reads the input directly,
+    // filtered detection writes into keyBuffer in the same pass
+    if (!filterKey)
+    {
+        dynamicsProcessor.process(mainBuffer);
+        return;
+    }
+
+    // keyBuffer is sized in prepareToPlay; oversized host blocks are split
+    // into chunks that fit rather than reallocating on the audio thread
+    const int maxChunk = keyBuffer.getNumSamples();
+    jassert(maxChunk > 0);
+    if (maxChunk <= 0)
+    {
+        dynamicsProcessor.process(mainBuffer);
+        return;
+    }
+
+    const int numChannels = mainBuffer.getNumChannels();
+    float* keyL = keyBuffer.getWritePointer(0);
+    float* keyR = numChannels > 1 ? keyBuffer.getWritePointer(1) : nullptr;
+
+    for (int start = 0; start < numSamples; start += maxChunk)
+    {
+        const int chunkSamples = juce::jmin(maxChunk, numSamples - start);
+        juce::AudioBuffer<float> chunk(mainBuffer.getArrayOfWritePointers(), numChannels, start, chunkSamples);
+
+        const float* inL = chunk.getReadPointer(0);
+        const float* inR = numChannels > 1 ? chunk.getReadPointer(1) : nullptr;
+
+        keyFilter.process(inL, inR, keyL, keyR, chunkSamples);
+        dynamicsProcessor.process(chunk, keyL, keyR);
+    }
 }
 
 bool OneKnobAudioProcessor::hasEditor() const { return true; }
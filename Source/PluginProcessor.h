@@ -2,6 +2,7 @@
 
 #include <JuceHeader.h>
 #include "DSP/DynamicsProcessor.h"
+#include "DSP/KeyFilter.h"
 
 class OneKnobAudioProcessor : public juce::AudioProcessor
 {
@@ -42,6 +43,10 @@ private:
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
     DynamicsProcessor dynamicsProcessor;
+    KeyFilter keyFilter;
+    juce::AudioBuffer<float> keyBuffer; // Filtered copy of the input, only used without a sidechain
+    bool keyFilterRunning = false;      // Key filter processed the previous block
+    bool keyFromSidechain = false;      // Key source of the previous block
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OneKnobAudioProcessor)
 };